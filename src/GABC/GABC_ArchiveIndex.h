@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017
+ *	Side Effects Software Inc.  All rights reserved.
+ *
+ * Redistribution and use of Houdini Development Kit samples in source and
+ * binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE `AS IS' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *----------------------------------------------------------------------------
+ */
+
+
+#ifndef __GABC_ArchiveIndex__
+#define __GABC_ArchiveIndex__
+
+#include "GABC_API.h"
+#include "GABC_Types.h"
+#include <UT/UT_Array.h>
+#include <UT/UT_BoundingBox.h>
+#include <UT/UT_Matrix4.h>
+#include <string>
+
+namespace GABC_NAMESPACE
+{
+
+/// A sidecar index stores the metadata that otherwise requires a walk of
+/// the whole Alembic hierarchy (the object list, node and animation types,
+/// constant bounds and constant transforms).  The index files live in a
+/// cache directory and are keyed on the archive's path, modification time
+/// and size, so a fresh process can answer these queries without touching
+/// the hierarchy, and a modified archive is indexed again.
+class GABC_API GABC_ArchiveIndex
+{
+public:
+    struct Object
+    {
+	std::string		myPath;
+	GABC_NodeType		myType;
+	GEO_AnimationType	myAnimation;
+	bool			myConstantBounds;
+	UT_BoundingBox		myBounds;
+    };
+    struct Transform
+    {
+	std::string		myPath;
+	UT_Matrix4D		myLocal;
+	UT_Matrix4D		myWorld;
+	bool			myInheritsXform;
+    };
+
+    GABC_ArchiveIndex();
+    ~GABC_ArchiveIndex();
+
+    /// The settings are initialized from the environment:
+    /// - @c HOUDINI_ALEMBIC_INDEX enables the indices when non-zero
+    /// - @c HOUDINI_ALEMBIC_INDEX_DIR sets the directory
+
+    /// @{
+    /// Enable reading and writing of sidecar indices (disabled by default)
+    static void		setEnabled(bool enable);
+    static bool		enabled();
+    /// @}
+
+    /// @{
+    /// The directory for the index files.  The default is a directory in
+    /// $HOUDINI_TEMP_DIR.
+    static void		setDirectory(const std::string &path);
+    static std::string	directory();
+    /// @}
+
+    void		clear();
+    void		swap(GABC_ArchiveIndex &other);
+
+    /// Load the index for the archive.  Returns false if there's no index
+    /// or the index doesn't match the archive on disk.
+    bool		load(const std::string &archive);
+    /// Save the index for the archive
+    bool		save(const std::string &archive) const;
+
+    /// Objects are stored in the order of a depth-first traversal
+    const UT_Array<Object>	&objects() const	{ return myObjects; }
+    /// Only constant transforms are stored
+    const UT_Array<Transform>	&transforms() const	{ return myTransforms; }
+
+    void		appendObject(const std::string &path,
+				GABC_NodeType type,
+				GEO_AnimationType atype,
+				const UT_BoundingBox *constant_bounds);
+    void		appendTransform(const std::string &path,
+				const UT_Matrix4D &local,
+				const UT_Matrix4D &world,
+				bool inherits);
+
+private:
+    UT_Array<Object>	myObjects;
+    UT_Array<Transform>	myTransforms;
+};
+
+}
+
+#endif
@@ -211,6 +211,7 @@ public:
     fpreal	time() const		{ return myTime; }
     bool	includeXform() const	{ return myIncludeXform; }
     bool	useVisibility() const	{ return myUseVisibility; }
+    bool	velocitySubframes() const { return myVelocitySubframes; }
     bool	staticTimeZero() const	{ return myStaticTimeZero; }
     bool	reusePrimitives() const	{ return myReusePrimitives; }
     bool	buildLocator() const	{ return myBuildLocator; }
@@ -258,6 +259,7 @@ public:
     void	setFrame(fpreal f, fpreal fps)	{ myTime = f/fps; }
     void	setIncludeXform(bool v)		{ myIncludeXform = v; }
     void	setUseVisibility(bool v)	{ myUseVisibility = v; }
+    void	setVelocitySubframes(bool v)	{ myVelocitySubframes = v; }
     void	setStaticTimeZero(bool v)	{ myStaticTimeZero = v; }
     void	setReusePrimitives(bool v,
 				   GA_Offset pts = GA_Offset(0),
@@ -400,6 +402,7 @@ private:
     bool	myPathAttributeChanged;	// Whether path attrib name changed
     bool	myReusePrimitives;	// Reuse primitives in input geometry
     bool	myUseVisibility;	// Use visibility
+    bool	myVelocitySubframes;	// Move P along v for subframes
     bool	myStaticTimeZero;	// All static objects have frame=0
     bool	myRecordTimeRange;
 
@@ -32,8 +32,10 @@
 #include "GABC_Include.h"
 #include "GABC_IObject.h"
 #include <SYS/SYS_AtomicInt.h>
+#include <SYS/SYS_Hash.h>
 #include <UT/UT_Lock.h>
-#include <UT/UT_Set.h>
+#include <UT/UT_Map.h>
+#include <UT/UT_TaskGroup.h>
 #include <UT/UT_IStream.h>
 #include <FS/FS_Reader.h>
 #include <FS/FS_IStreamDevice.h>
@@ -62,7 +64,9 @@ public:
     using gabc_istream = FS_IStreamDevice;
     using gabc_streambuf = FS_IStreamDeviceBuffer;
     using IArchive = Alembic::Abc::IArchive;
-    using SetType = UT_Set<GABC_IItem *>;
+    using IArrayProperty = Alembic::Abc::IArrayProperty;
+    using ArraySamplePtr = Alembic::Abc::ArraySamplePtr;
+    using index_t = Alembic::Abc::index_t;
 
     /// Destructor
     ~GABC_IArchive();
@@ -90,9 +94,78 @@ public:
     /// Purge all objects references
     void		purgeObjects();
 
-    /// Close and reopen the archive with the given number of file streams
-    /// (-1 is to use the default)
-    void		reopenStream(int num_ogawa_streams = -1);
+    /// Number of file streams available to threads reading from the archive
+    int			numStreams() const	{ return myNumStreams; }
+
+    /// @{
+    /// The maximum number of file streams opened for each Ogawa archive.
+    /// Reading threads are handed a free stream, so this is the number of
+    /// threads which can read from an archive concurrently.  Streams are
+    /// only opened once a thread needs one.  The default is the value of
+    /// HOUDINI_ALEMBIC_OGAWA_STREAMS, or 4 (at most the number of
+    /// processors) if that isn't set, since each stream of each open archive
+    /// holds a file descriptor.  Only archives opened after the change are
+    /// affected.
+    static void		setMaxStreams(int num_streams);
+    static int		maxStreams();
+    /// @}
+
+    /// @{
+    /// Whether Ogawa archives on local file systems are memory mapped rather
+    /// than read through file streams.  Archives on network file systems are
+    /// always read through streams.  This requires Alembic 1.7 or later and
+    /// only affects archives opened after the change.  Memory mapping is
+    /// disabled by default: a mapped archive that is overwritten in place
+    /// (rather than replaced by a new file) faults with SIGBUS on access.
+    static void		setUseMemoryMapping(bool enable);
+    static bool		useMemoryMapping();
+    /// @}
+
+    /// @{
+    /// Read-ahead of animated array samples.  When enabled, reading sample
+    /// @c i of an array property schedules sample @c i+1 to be read in the
+    /// background, since sequential playback almost always reads it next.
+    /// The samples read ahead are kept in a buffer of each archive, bounded
+    /// by the read-ahead memory (in megabytes).  Only Ogawa archives read
+    /// ahead.  Read-ahead is disabled by default.
+    static void		setReadAhead(bool enable);
+    static bool		readAhead();
+    static void		setReadAheadMemory(int64 megabytes);
+    static int64	readAheadMemory();
+    /// @}
+
+    /// @{
+    /// The number of recently read samples of each animated array property
+    /// kept by the archive.  Interpolating between samples @c i and @c i+1,
+    /// then @c i+1 and @c i+2 (as during playback or motion blur), reuses
+    /// the shared sample from the window rather than decoding it again.  A
+    /// window of 0 disables it.  The window is bounded by the number of
+    /// samples per property rather than by memory, so every animated array
+    /// read keeps its recent samples alive; it is disabled by default.
+    static void		setSampleWindow(int nsamples);
+    static int		sampleWindow();
+    /// @}
+
+    /// @{
+    /// @private
+    /// Called by GABC_IArray to use and schedule read-ahead samples
+    bool		readAheadFind(const IArrayProperty &prop,
+				index_t index,
+				ArraySamplePtr &sample);
+    void		readAheadSchedule(const IArrayProperty &prop,
+				index_t index);
+    /// @}
+
+    /// @{
+    /// @private
+    /// Called by GABC_IArray to use the window of recently read samples
+    bool		sampleWindowFind(const IArrayProperty &prop,
+				index_t index,
+				ArraySamplePtr &sample);
+    void		sampleWindowStore(const IArrayProperty &prop,
+				index_t index,
+				const ArraySamplePtr &sample);
+    /// @}
 	
     /// @{
     /// @private
@@ -118,7 +191,8 @@ public:
 
     /// @{
     /// Open an archive.  Please use GABC_Util::open instead
-    /// This method is @b not thread-safe.  You must lock around it.
+    /// Different archives may be opened concurrently.  Concurrent opens of
+    /// the same path share a single archive.
     /// @private
     static GABC_IArchivePtr	open(const std::string &filename,
 				     int num_ogawa_streams = -1);
@@ -126,13 +200,16 @@ public:
 
 private:
     void		 openArchive(const std::string &path, int num_streams);
+    void		 openLayeredArchive(
+				const std::vector<std::string> &layers,
+				int num_streams);
     void		 closeAndDelete();
+    void		 eraseFromCache();
     /// Access to the file lock - required for non-thread safe HDF5
     UT_Lock		&getLock() const	{ return *theLock; }
     friend class	 GABC_AutoLock;
 
-    GABC_IArchive(const std::string &filename,
-		  int num_streams = -1);
+    GABC_IArchive(const std::string &filename);
 
     // At the current time, HDF5 requires a *global* lock across all files.
     // Wouldn't it be nice if it could have a per-file lock?
@@ -156,14 +233,86 @@ private:
 		delete myStream;
 	    }
 	gabc_istream	*myReader;
-	gabc_streambuf	*myStreamBuf;
+	std::streambuf	*myStreamBuf;
 	std::istream	*myStream;
     };
     UT_Array<gabc_streamentry> myStreams;
     IArchive		 myArchive;
-    SetType		 myObjects;
+    // Items referencing the archive are kept in intrusive lists, so
+    // registering an item doesn't allocate.  The lists are sharded by the
+    // item's address so threads creating items don't contend on one lock.
+    static const int	 theNumItemShards = 16;
+    struct gabc_itemshard
+    {
+	gabc_itemshard() : myHead(nullptr) {}
+	UT_Lock		 myLock;
+	GABC_IItem	*myHead;
+    };
+    static int		 itemShard(const GABC_IItem *item);
+    template <typename FUNC>
+    void		 forEachItem(const FUNC &func);
+
+    gabc_itemshard	 myItemShards[theNumItemShards];
+
+    // Samples which have been (or are being) read ahead, keyed on the
+    // property reader and sample index.  The entry keeps the reader alive
+    // so its address can't be reused while it's in the buffer.
+    struct gabc_readaheadkey
+    {
+	bool	operator==(const gabc_readaheadkey &k) const
+		    { return myReader == k.myReader && myIndex == k.myIndex; }
+	const void	*myReader;
+	index_t		 myIndex;
+    };
+    struct gabc_readaheadhash
+    {
+	size_t	operator()(const gabc_readaheadkey &k) const
+		    { return SYSwang_inthash64((uint64)(uintptr_t)k.myReader)
+			    ^ SYSwang_inthash64(k.myIndex); }
+    };
+    struct gabc_readaheadentry
+    {
+	IArrayProperty	 myProperty;
+	ArraySamplePtr	 mySample;	// Null while it's being read
+	int64		 myBytes;
+	int64		 myStamp;
+    };
+    using ReadAheadBuffer = UT_Map<gabc_readaheadkey, gabc_readaheadentry,
+				   gabc_readaheadhash>;
+
+    void		 readAheadStore(const gabc_readaheadkey &key,
+				const ArraySamplePtr &sample);
+    void		 readAheadClear();
+
+    UT_Lock		 myReadAheadLock;
+    ReadAheadBuffer	 myReadAheadBuffer;
+    int64		 myReadAheadBytes;
+    int64		 myReadAheadStamp;
+    UT_TaskGroup	 myReadAheadTasks;
+
+    // The most recently read samples of each property reader, replaced in
+    // round-robin order.  Like the read-ahead buffer, the window keeps the
+    // reader alive.
+    struct gabc_samplewindow
+    {
+	gabc_samplewindow() : myNext(0) {}
+
+	IArrayProperty		 myProperty;
+	UT_Array<index_t>	 myIndices;
+	UT_Array<ArraySamplePtr> mySamples;
+	exint			 myNext;
+    };
+    using SampleWindowMap = UT_Map<const void *, gabc_samplewindow>;
+
+    void		 sampleWindowClear();
+
+    UT_Lock		 mySampleWindowLock;
+    SampleWindowMap	 mySampleWindows;
+    int			 myNumStreams;
     bool		 myPurged;
     bool		 myIsOgawa;
+    UT_Lock		 myOpenLock;
+    bool		 myOpened;
 };
 
 static inline void intrusive_ptr_add_ref(GABC_IArchive *i) { i->incref(); }
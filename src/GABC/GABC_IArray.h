@@ -78,6 +78,22 @@ public:
 		const IArrayProperty &prop, const ISampleSelector &iss,
 		GT_Type type);
 
+    /// @{
+    /// Samples read from array properties are shared through a process-wide
+    /// cache keyed on the digest Alembic stores with each sample, so
+    /// identical samples are only decoded once, even when they're read for
+    /// different primitives, frames or archives.  The size of the cache is
+    /// in megabytes (a size of 0 disables the cache).  The default is 256
+    /// megabytes.  Since samples are keyed on their digest rather than their
+    /// archive, the cache is only emptied by clearSampleCache() (which
+    /// GABC_Util::clearCache() calls when clearing every archive).
+    static void		setSampleCacheSize(int64 megabytes);
+    static int64	sampleCacheSize();
+    /// Memory held by the cache (in bytes)
+    static int64	sampleCacheMemory();
+    static void		clearSampleCache();
+    /// @}
+
     GABC_IArray()
 	: GABC_IItem()
 	, myContainer()
@@ -301,6 +301,150 @@ public:
 private:
 };
 
+/// Alembic stores uv's as a 2-tuple, but Houdini expects a 3-tuple.  This
+/// presents a 2-tuple array as a 3-tuple with a z of 0, reading the source
+/// values in place rather than copying them into a new array.
+class GABC_API GABC_IGTUVArray : public GT_DataArray
+{
+public:
+    GABC_IGTUVArray(const GT_DataArrayHandle &uv)
+	: GT_DataArray()
+	, myUV(uv)
+	, myData(uv->getF32Array(myBuffer))
+    {
+	UT_ASSERT(uv->getTupleSize() == 2);
+    }
+    virtual ~GABC_IGTUVArray()
+    {
+    }
+
+    /// @{
+    /// Methods defined on GT_DataArray
+    virtual const char	*className() const	{ return "GABC_IGTUVArray"; }
+    virtual GT_Storage	getStorage() const	{ return GT_STORE_REAL32; }
+    virtual GT_Type	getTypeInfo() const	{ return myUV->getTypeInfo(); }
+    virtual GT_Size	getTupleSize() const	{ return 3; }
+    virtual GT_Size	entries() const		{ return myUV->entries(); }
+    virtual int64	getMemoryUsage() const
+			{
+			    int64	mem = sizeof(*this) + myUV->getMemoryUsage();
+			    if (myBuffer)
+				mem += myBuffer->getMemoryUsage();
+			    return mem;
+			}
+
+    virtual const uint8		*get(GT_Offset off, uint8 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+    virtual const int32		*get(GT_Offset off, int32 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+    virtual const int64		*get(GT_Offset off, int64 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+    virtual const fpreal16	*get(GT_Offset off, fpreal16 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+    virtual const fpreal64	*get(GT_Offset off, fpreal64 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+    virtual const fpreal32	*get(GT_Offset off, fpreal32 *buf, int sz) const
+				    { return getTuple(off, buf, sz); }
+
+    virtual uint8	getU8(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+    virtual int32	getI32(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+    virtual int64	getI64(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+    virtual fpreal16	getF16(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+    virtual fpreal32	getF32(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+    virtual fpreal64	getF64(GT_Offset offset, int index=0) const
+			    { return getValue(offset, index); }
+
+    virtual GT_String	getS(GT_Offset, int) const		{ return NULL; }
+    virtual GT_Size	getStringIndexCount() const		{ return -1; }
+    virtual GT_Offset	getStringIndex(GT_Offset, int) const	{ return -1; }
+    virtual void	getIndexedStrings(UT_StringArray &,
+				    UT_IntArray &) const {}
+
+    virtual void doImport(GT_Offset idx, uint8 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+    virtual void doImport(GT_Offset idx, int32 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+    virtual void doImport(GT_Offset idx, int64 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+    virtual void doImport(GT_Offset idx, fpreal16 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+    virtual void doImport(GT_Offset idx, fpreal32 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+    virtual void doImport(GT_Offset idx, fpreal64 *data, GT_Size size) const
+			{ getTuple(idx, data, size < 1 ? 3 : SYSmin(size, 3)); }
+
+    virtual void doFillArray(uint8 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 { t_UVFill(data, start, length, tsize, stride); }
+    virtual void doFillArray(int32 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 { t_UVFill(data, start, length, tsize, stride); }
+    virtual void doFillArray(int64 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 { t_UVFill(data, start, length, tsize, stride); }
+    virtual void doFillArray(fpreal16 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 { t_UVFill(data, start, length, tsize, stride); }
+    virtual void doFillArray(fpreal32 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 {
+		     // Consumers that only want the 2-tuple get a straight copy
+		     if (tsize == 2 && stride <= 2)
+		     {
+			 memcpy(data, myData + start*2,
+				 length*2*sizeof(fpreal32));
+		     }
+		     else
+			 t_UVFill(data, start, length, tsize, stride);
+		 }
+    virtual void doFillArray(fpreal64 *data, GT_Offset start, GT_Size length,
+			int tsize, int stride) const
+		 { t_UVFill(data, start, length, tsize, stride); }
+    /// @}
+
+private:
+    inline fpreal32
+    getValue(GT_Offset offset, int index) const
+		{
+		    UT_ASSERT_P(offset>=0 && offset<entries());
+		    UT_ASSERT_P(index>=0 && index<3);
+		    return index < 2 ? myData[offset*2 + index] : 0;
+		}
+    template <typename DEST_POD_T> inline const DEST_POD_T *
+    getTuple(GT_Offset off, DEST_POD_T *buf, int sz) const
+		{
+		    const fpreal32	*src = myData + off*2;
+		    for (int i = 0; i < sz; ++i)
+			buf[i] = i < 2 ? src[i] : 0;
+		    return buf;
+		}
+    template <typename DEST_POD_T> inline void
+    t_UVFill(DEST_POD_T *dest, GT_Offset start, GT_Size length,
+		    int tsize, int stride) const
+		{
+		    if (tsize < 1)
+			tsize = 3;
+		    stride = SYSmax(stride, tsize);
+		    int n = SYSmin(tsize, 3);
+		    const fpreal32 *src = myData + start*2;
+		    for (GT_Offset i = 0; i < length; ++i, src += 2,
+						    dest += stride)
+		    {
+			for (int j = 0; j < n; ++j)
+			    dest[j] = j < 2 ? src[j] : 0;
+		    }
+		}
+
+    GT_DataArrayHandle	 myUV;		// 2-tuple source array
+    GT_DataArrayHandle	 myBuffer;	// Source converted to fpreal32
+    const fpreal32	*myData;
+};
+
 using GABC_GTUnsigned8Array = GABC_IGTArray<uint8>;
 using GABC_GTInt32Array = GABC_IGTArray<int32>;
 using GABC_GTInt64Array = GABC_IGTArray<int64>;
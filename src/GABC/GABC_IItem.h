@@ -70,6 +70,11 @@ public:
 
 private:
     GABC_IArchivePtr	myArchive;
+
+    // Links in the archive's list of items (maintained by GABC_IArchive)
+    GABC_IItem		*myPrev;
+    GABC_IItem		*myNext;
+    friend class	 GABC_IArchive;
 };
 }
 
@@ -69,6 +69,7 @@ public:
     using TimeSamplingPtr = Alembic::Abc::TimeSamplingPtr;
     using GeometryScope = Alembic::AbcGeom::GeometryScope;
     using CompoundPropertyReaderPtr = Alembic::Abc::CompoundPropertyReaderPtr;
+    using XformSample = Alembic::AbcGeom::XformSample;
 
     GABC_IObject();
     GABC_IObject(const GABC_IObject &obj);
@@ -166,7 +167,10 @@ public:
 	GABC_LOAD_GL_OPTIMIZED		= 0x4000,
 	GABC_LOAD_USE_GL_CACHE		= 0x8000,
 	// Don't bake attributes on the packed prim into the geometry
-	GABC_LOAD_NO_PACKED_ATTRIBS	= 0x10000
+	GABC_LOAD_NO_PACKED_ATTRIBS	= 0x10000,
+	// Evaluate subframes from the nearest sample, moving P along v
+	// rather than interpolating samples
+	GABC_LOAD_VELOCITY_SUBFRAMES		= 0x20000
     };
 
     UT_StringHolder getAttributes(const GEO_PackedNameMapPtr &namemap,
@@ -312,6 +316,12 @@ public:
 				    bool &inheritsXform) const;
     /// @}
 
+    /// Blend two transform samples by interpolating their individual
+    /// operations (rather than the resulting matrices).
+    static M44d		blendXformSamples(const XformSample &s0,
+				    const XformSample &s1,
+				    fpreal bias);
+
     /// Alembic's 128b prop hash wang'hashed to 64b. Returns false if no hash
     /// exists (getPropertiesHash() returns false, such as for HDF5).
     bool		getPropertiesHash(int64 &hash) const;
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017
+ *	Side Effects Software Inc.  All rights reserved.
+ *
+ * Redistribution and use of Houdini Development Kit samples in source and
+ * binary forms, with or without modification, are permitted provided that the
+ * following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. The name of Side Effects Software may not be used to endorse or
+ *    promote products derived from this software without specific prior
+ *    written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE `AS IS' AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+ * OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+ * NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *----------------------------------------------------------------------------
+ */
+
+#ifndef __GABC_OgawaCache__
+#define __GABC_OgawaCache__
+
+#include "GABC_API.h"
+#include <SYS/SYS_Types.h>
+#include <string>
+
+namespace GABC_NAMESPACE
+{
+
+/// HDF5 archives can only be read under a global lock, since the HDF5
+/// library isn't thread-safe.  When enabled, this cache converts an HDF5
+/// archive to an Ogawa file in a local directory the first time it's opened,
+/// and the converted file is read instead.  Converted files are keyed on the
+/// source path, modification time and size, so modified archives are
+/// converted again.  The least recently used files are removed when the
+/// cache directory grows beyond its size limit.
+class GABC_API GABC_OgawaCache
+{
+public:
+    /// The settings are initialized from the environment:
+    /// - @c HOUDINI_ALEMBIC_OGAWA_CACHE enables the cache when non-zero
+    /// - @c HOUDINI_ALEMBIC_OGAWA_CACHE_DIR sets the directory
+    /// - @c HOUDINI_ALEMBIC_OGAWA_CACHE_SIZE sets the size (in megabytes)
+
+    /// @{
+    /// Enable conversion of HDF5 archives (disabled by default)
+    static void		setEnabled(bool enable);
+    static bool		enabled();
+    /// @}
+
+    /// @{
+    /// The directory for the converted files.  The default is a directory
+    /// in $HOUDINI_TEMP_DIR.
+    static void		setDirectory(const std::string &path);
+    static std::string	directory();
+    /// @}
+
+    /// @{
+    /// The maximum size (in megabytes) of the files in the cache directory.
+    /// The default is 10240 megabytes.
+    static void		setMaxSize(int64 megabytes);
+    static int64	maxSize();
+    /// @}
+
+    /// Find the converted Ogawa file for an HDF5 archive.  This doesn't
+    /// read the source archive, so it doesn't require the HDF5 lock.
+    static bool		find(const std::string &path, std::string &converted);
+
+    /// Convert the HDF5 archive to an Ogawa file in the cache.  The caller
+    /// must hold the HDF5 lock.
+    static bool		convert(const std::string &path,
+				std::string &converted);
+};
+
+}
+
+#endif
@@ -166,7 +166,10 @@ public:
 
     const GABC_IObject	&object() const;
     const UT_StringHolder &filename() const { return myFilename; }
-    UT_StringHolder	  intrinsicFilename(const GU_PrimPacked *prim) const { return myFilename; }
+    UT_StringHolder	  intrinsicFilename(const GU_PrimPacked *prim) const
+			    { return GABC_Util::baseFilename(myFilename.toStdString()); }
+    UT_StringHolder	  intrinsicFileLayers(const GU_PrimPacked *prim) const
+			    { return GABC_Util::layerFiles(myFilename.toStdString()); }
     const UT_StringHolder &objectPath() const	{ return myObjectPath; }
     UT_StringHolder	 intrinsicObjectPath(const GU_PrimPacked *prim) const { return myObjectPath; }
     UT_StringHolder	 intrinsicSourcePath(const GU_PrimPacked *prim) const
@@ -179,6 +182,8 @@ public:
     bool                 intrinsicUseTransform(const GU_PrimPacked *prim) const { return myUseTransform; }
     bool		 useVisibility() const	{ return myUseVisibility; }
     bool                 intrinsicUseVisibility(const GU_PrimPacked *prim) const { return myUseVisibility; }
+    bool		 velocitySubframes() const { return myVelocitySubframes; }
+    bool                 intrinsicVelocitySubframes(const GU_PrimPacked *prim) const { return myVelocitySubframes; }
     GABC_NodeType	 nodeType() const	{ return object().nodeType(); }
     GEO_AnimationType	 animationType() const;
     int			 currentLoadStyle() const { return myCache.loadStyle();}
@@ -216,6 +221,9 @@ public:
     void	setFrame(GU_PrimPacked *prim, fpreal f);
     void	setUseTransform(GU_PrimPacked *prim, bool v);
     void	setUseVisibility(GU_PrimPacked *prim, bool v);
+    /// Evaluate subframes from the nearest sample by moving P along the
+    /// velocities, rather than interpolating samples.
+    void	setVelocitySubframes(GU_PrimPacked *prim, bool v);
 
     void	setViewportCache(GT_AlembicCache *cache) const;
 protected:
@@ -315,6 +323,7 @@ private:
     fpreal			myFrame;
     bool			myUseTransform;
     bool			myUseVisibility;
+    bool			myVelocitySubframes;
 
     mutable GABC_VisibilityType myConstVisibility;
     mutable bool		myHasConstBounds;
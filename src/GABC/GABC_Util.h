@@ -35,6 +35,7 @@
 #include "GABC_OProperty.h"
 #include "GABC_Types.h"
 #include <SYS/SYS_Types.h>
+#include <UT/UT_Array.h>
 #include <UT/UT_BoundingBox.h>
 #include <UT/UT_JSONParser.h>
 #include <UT/UT_Matrix4.h>
@@ -215,6 +216,82 @@ public:
     static void		setFileCacheSize(int nfiles);
     /// Get the file cache size
     static int		fileCacheSize();
+    /// Set the memory budget (in megabytes) for the file cache.  When the
+    /// estimated memory held by cached archives exceeds the budget, the
+    /// least recently used archives are evicted.  A budget of 0 disables
+    /// the memory limit.
+    static void		setFileCacheMemory(int64 megabytes);
+    /// Get the memory budget (in megabytes) for the file cache
+    static int64	fileCacheMemory();
+    /// Set the minimum time (in seconds) between checks of whether a cached
+    /// archive has been modified on disk.  With an interval of 0 (the
+    /// default), the file is checked every time the archive is accessed.
+    /// With a negative interval, files are only checked after a call to
+    /// bumpFileCheckGeneration().
+    static void		setFileCheckInterval(fpreal seconds);
+    /// Get the minimum time between checks for modified archives
+    static fpreal	fileCheckInterval();
+    /// Force every cached archive to be checked for modifications the next
+    /// time it's accessed (i.e. at the start of a cook or render).
+    static void		bumpFileCheckGeneration();
+
+    /// Statistics of the archive cache and the per-archive transform and
+    /// visibility caches.  Counters accumulate from the start of the
+    /// process (or the last resetCacheStats()).  Times are in seconds and
+    /// are summed over all threads.
+    class GABC_API CacheStats
+    {
+    public:
+	CacheStats();
+
+	int64		myArchiveHits;
+	int64		myArchiveMisses;
+	int64		myArchiveEvictions;
+	int64		myTransformHits;
+	int64		myTransformMisses;
+	int64		myVisibilityHits;
+	int64		myVisibilityMisses;
+	/// Number of archives in the cache
+	int64		myNumArchives;
+	/// Estimate of the memory held by the cached archives (in bytes).
+	/// This is what the file cache memory budget applies to.
+	int64		myMemoryUsage;
+	/// Memory held by the samples shared between archives (in bytes),
+	/// which is bounded by GABC_IArray::sampleCacheSize() rather than the
+	/// file cache budget
+	int64		mySampleCacheMemory;
+	/// Time spent opening archives
+	fpreal64	myOpenTime;
+	/// Time spent checking archives for modifications
+	fpreal64	myStatTime;
+	/// Time spent reading samples from archives
+	fpreal64	myDecodeTime;
+	/// Time spent waiting for cache locks
+	fpreal64	myLockWaitTime;
+    };
+    /// Get the current cache statistics
+    static void		getCacheStats(CacheStats &stats);
+    /// Reset the cache counters
+    static void		resetCacheStats();
+    /// Add to the time spent reading samples.  This lets sample reads
+    /// outside of GABC_Util be included in the statistics.
+    static void		addDecodeTime(int64 nanoseconds);
+
+    /// Schedule a background task that opens the archive, resolves the
+    /// given objects and reads their transforms, visibility and geometry
+    /// samples between @c start_time and @c end_time into the caches.  The
+    /// method returns immediately.  Geometry samples are only read when
+    /// GABC_IArchive::readAhead() is enabled.  With an empty list of
+    /// objects, only the archive and its hierarchy are loaded.  Pipeline
+    /// tools should schedule this as early as they know the files they'll
+    /// read, well before reading them.  Failures are logged once to the
+    /// mantra error log, since there's no caller to report them to.
+    static void		prefetch(const std::string &filename,
+				const PathList &objectpaths,
+				fpreal start_time,
+				fpreal end_time);
+    /// Wait for all scheduled prefetches to finish
+    static void		waitForPrefetch();
 
     //
     //  Events
@@ -225,6 +302,30 @@ public:
     static bool		addEventHandler(const std::string &filename,
 				const ArchiveEventHandlerPtr &handler);
 
+    //
+    //  Layered Archives
+    //
+
+    /// Build the filename of an archive made of several layered files.  The
+    /// layered filename can be used wherever a filename is expected, and
+    /// the archive is cached on the whole list of layers.  Objects and
+    /// properties in later layers override those in earlier layers.  This
+    /// requires Alembic 1.7 or later.
+    static std::string	layeredFilename(const PathList &layers);
+    /// Split a filename into its layers.  Returns false if the filename
+    /// only has a single layer.
+    static bool		splitLayeredFilename(const std::string &filename,
+				PathList &layers);
+    /// The first file of a layered archive, or the filename itself if it
+    /// isn't layered
+    static std::string	baseFilename(const std::string &filename);
+    /// The files layered over the base file, separated by spaces (with
+    /// paths containing spaces quoted), as in the Alembic SOP's Layer Files
+    /// parameter.  This is empty if the filename isn't layered.
+    static std::string	layerFiles(const std::string &filename);
+    /// A readable form of a possibly layered filename for messages
+    static std::string	displayFilename(const std::string &filename);
+
     //
     //  Find Objects in Alembic Hierarchy
     //
@@ -237,6 +338,27 @@ public:
     /// Return a list of all the objects in an Alembic file
     static const PathList	&getObjectList(const std::string &filename,
 					bool include_face_sets=false);
+    /// Get the animation type of an object's intrinsic properties.  When
+    /// sidecar indices are enabled (see GABC_ArchiveIndex), this doesn't
+    /// need to read the object from the archive.
+    static bool			 getAnimationType(const std::string &filename,
+					const std::string &objectpath,
+					GEO_AnimationType &atype);
+    /// Get the bounds of an object if they're constant.  Returns false if
+    /// the object has no bounds or the bounds are animated.
+    static bool			 getConstantBounds(const std::string &filename,
+					const std::string &objectpath,
+					UT_BoundingBox &box);
+    /// Equivalent to GABC_IObject::getAnimationType(false), but answered
+    /// from the sidecar index when one is loaded for the object's archive.
+    static GEO_AnimationType	 getAnimationType(const GABC_IObject &obj);
+    /// Equivalent to GABC_IObject::getBoundingBox(), but constant bounds are
+    /// answered from the sidecar index when one is loaded for the object's
+    /// archive.
+    static bool			 getBoundingBox(const GABC_IObject &obj,
+					fpreal t,
+					UT_BoundingBox &box,
+					bool &isconst);
 
     //
     //  Matrix Conversion
@@ -289,6 +411,20 @@ public:
 				UT_Matrix4D &xform,
 				bool &isConstant,
 				bool &inheritsXform);
+    /// Get the world transforms for a list of nodes in an Alembic file at a
+    /// single time.  Ancestors shared by several nodes are only evaluated
+    /// once, so this is much faster than calling getWorldTransform() for each
+    /// node.  Nodes that don't exist in the archive are given an identity
+    /// transform and have their @c found flag cleared.
+    ///
+    /// The method returns false if the archive couldn't be loaded.
+    static bool		 getWorldTransforms(
+				const std::string &filename,
+				const PathList &objectpaths,
+				fpreal sample_time,
+				UT_Array<UT_Matrix4D> &xforms,
+				UT_Array<bool> &isConstant,
+				UT_Array<bool> &found);
     /// Test whether an object is static or has an animated transform
     static bool		isTransformAnimated(
 				const GABC_IObject &object);
@@ -303,6 +439,16 @@ public:
 				fpreal sample_time,
 				bool &animated,
 				bool check_parent);
+    /// Get the visibility of a GABC_IObject, including the visibility
+    /// inherited from its parents.  When no visibility in the archive is
+    /// animated, the first query resolves the visibility of every object in
+    /// a single pass, so subsequent queries don't depend on the depth of the
+    /// hierarchy.  Archives with animated visibility are resolved per object,
+    /// as with getVisibility() and @c check_parent.
+    static GABC_VisibilityType getResolvedVisibility(
+				const GABC_IObject &object,
+				fpreal sample_time,
+				bool &animated);
 
     //
     //  Walk Alembic Hierarchy
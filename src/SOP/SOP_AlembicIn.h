@@ -142,6 +142,7 @@ private:
 	bool					myBuildAbcXform;
 	bool					myIncludeXform;
 	bool					myUseVisibility;
+	bool					myVelocitySubframes;
 	bool					myStaticTimeZero;
 	bool					myBuildLocator;
     };